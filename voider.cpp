@@ -11,12 +11,47 @@
 #include <cmath>
 #include <iomanip>
 #include <sstream>
+#include <cstdint>
+#include <cstring>
 
 #ifdef _WIN32
-#include <windows.h>
 #ifndef NOMINMAX
 #define NOMINMAX
 #endif
+#include <windows.h>
+#include <conio.h>
+#else
+#include <termios.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/select.h>
+#endif
+
+#ifdef VOIDER_COUNT_ALLOCS
+#include <new>
+
+// Test hook: build with -DVOIDER_COUNT_ALLOCS to count heap allocations made
+// while the animated display path is running.
+namespace AllocCounter {
+    size_t allocations = 0;
+    size_t frames = 0;
+}
+
+void* operator new(size_t size) {
+    ++AllocCounter::allocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+#endif
 #endif
 
 namespace Colors {
@@ -30,6 +65,18 @@ namespace Colors {
     };
 }
 
+namespace Keys {
+    constexpr int None = -1;
+    constexpr int Up = 1000;
+    constexpr int Down = 1001;
+    constexpr int Left = 1002;
+    constexpr int Right = 1003;
+    constexpr int PageUp = 1004;
+    constexpr int PageDown = 1005;
+    constexpr int Home = 1006;
+    constexpr int End = 1007;
+}
+
 #ifdef _WIN32
 class Console {
 public:
@@ -91,14 +138,51 @@ public:
     }
 
     static bool isWindows() { return true; }
+
+    static bool isInteractive() {
+        DWORD mode;
+        HANDLE in = GetStdHandle(STD_INPUT_HANDLE);
+        return hConsole != INVALID_HANDLE_VALUE && GetConsoleMode(in, &mode);
+    }
+
+    static bool terminalSize(int& rows, int& cols) {
+        CONSOLE_SCREEN_BUFFER_INFO csbi;
+        if (hConsole == INVALID_HANDLE_VALUE || !GetConsoleScreenBufferInfo(hConsole, &csbi)) {
+            return false;
+        }
+        rows = csbi.srWindow.Bottom - csbi.srWindow.Top + 1;
+        cols = csbi.srWindow.Right - csbi.srWindow.Left + 1;
+        return true;
+    }
+
+    static void enterRawMode() {}
+    static void leaveRawMode() {}
+
+    static int readKey() {
+        int c = _getch();
+        if (c == 0 || c == 224) {
+            switch (_getch()) {
+                case 72: return Keys::Up;
+                case 80: return Keys::Down;
+                case 75: return Keys::Left;
+                case 77: return Keys::Right;
+                case 73: return Keys::PageUp;
+                case 81: return Keys::PageDown;
+                case 71: return Keys::Home;
+                case 79: return Keys::End;
+                default: return Keys::None;
+            }
+        }
+        return c;
+    }
     
-    static std::string borderStart(int line, int total) {
+    static const char* borderStart(int line, int total) {
         if (line == 0) return "+ ";
         else if (line == total - 1) return "+ ";
         else return "| ";
     }
     
-    static std::string borderEnd(int line, int total) {
+    static const char* borderEnd(int line, int total) {
         if (line == 0) return " +";
         else if (line == total - 1) return " +";
         else return " |";
@@ -146,18 +230,91 @@ public:
     }
 
     static bool isWindows() { return false; }
+
+    static bool isInteractive() {
+        return isatty(STDIN_FILENO) && isatty(STDOUT_FILENO);
+    }
+
+    static bool terminalSize(int& rows, int& cols) {
+        struct winsize ws;
+        if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) != 0 || ws.ws_row == 0 || ws.ws_col == 0) {
+            return false;
+        }
+        rows = ws.ws_row;
+        cols = ws.ws_col;
+        return true;
+    }
+
+    static void enterRawMode() {
+        if (tcgetattr(STDIN_FILENO, &originalTermios()) != 0) return;
+        struct termios raw = originalTermios();
+        raw.c_lflag &= ~(ICANON | ECHO | ISIG);
+        raw.c_cc[VMIN] = 1;
+        raw.c_cc[VTIME] = 0;
+        tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw);
+    }
+
+    static void leaveRawMode() {
+        tcsetattr(STDIN_FILENO, TCSAFLUSH, &originalTermios());
+    }
+
+    static int readKey() {
+        unsigned char c;
+        if (read(STDIN_FILENO, &c, 1) != 1) return 'q';
+        if (c != 27) return c;
+
+        char seq[3] = {0, 0, 0};
+        if (!pendingInput() || read(STDIN_FILENO, &seq[0], 1) != 1) return 27;
+        if (!pendingInput() || read(STDIN_FILENO, &seq[1], 1) != 1) return 27;
+        if (seq[0] != '[' && seq[0] != 'O') return Keys::None;
+
+        if (seq[1] >= '0' && seq[1] <= '9') {
+            if (!pendingInput() || read(STDIN_FILENO, &seq[2], 1) != 1) return Keys::None;
+            if (seq[2] != '~') return Keys::None;
+            switch (seq[1]) {
+                case '1': case '7': return Keys::Home;
+                case '4': case '8': return Keys::End;
+                case '5': return Keys::PageUp;
+                case '6': return Keys::PageDown;
+                default: return Keys::None;
+            }
+        }
+        switch (seq[1]) {
+            case 'A': return Keys::Up;
+            case 'B': return Keys::Down;
+            case 'C': return Keys::Right;
+            case 'D': return Keys::Left;
+            case 'H': return Keys::Home;
+            case 'F': return Keys::End;
+            default: return Keys::None;
+        }
+    }
     
-    static std::string borderStart(int line, int total) {
+    static const char* borderStart(int line, int total) {
         if (line == 0) return "\u250c ";
         else if (line == total - 1) return "\u2514 ";
         else return "\u2502 ";
     }
     
-    static std::string borderEnd(int line, int total) {
+    static const char* borderEnd(int line, int total) {
         if (line == 0) return " \u2510";
         else if (line == total - 1) return " \u2518";
         else return " \u2502";
     }
+
+private:
+    static struct termios& originalTermios() {
+        static struct termios saved;
+        return saved;
+    }
+
+    static bool pendingInput() {
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(STDIN_FILENO, &fds);
+        struct timeval tv = {0, 50000};
+        return select(STDIN_FILENO + 1, &fds, nullptr, nullptr, &tv) > 0;
+    }
 };
 #endif
 
@@ -227,9 +384,58 @@ std::string repeat(const std::string& str, int times, const std::string& separat
     return result;
 }
 
-std::string stripColorCodes(const std::string& str) {
-    std::string result;
-    result.reserve(str.length());
+// Describes every content line without materialising it: line i only depends
+// on i (pattern parity), so any character can be computed directly.
+class LineSource {
+public:
+    LineSource(const std::string& word, const std::string& separator, int repetitions, int pattern)
+        : separator(separator), repetitions(repetitions) {
+        if (pattern == 2) {
+            words[0] = toUpper(word);
+            words[1] = toLower(word);
+        } else {
+            words[0] = word;
+            words[1] = word;
+        }
+    }
+
+    const std::string& word(int lineIndex) const {
+        return words[lineIndex % 2];
+    }
+
+    size_t contentLength() const {
+        if (repetitions <= 0) return 0;
+        size_t reps = static_cast<size_t>(repetitions);
+        return words[0].length() * reps + separator.length() * (reps - 1);
+    }
+
+    char charAt(int lineIndex, size_t column) const {
+        const std::string& w = word(lineIndex);
+        size_t pos = column % (w.length() + separator.length());
+        return (pos < w.length()) ? w[pos] : separator[pos - w.length()];
+    }
+
+    std::string content(int lineIndex) const {
+        return repeat(word(lineIndex), repetitions, separator);
+    }
+
+    // Appends line content to out; does not allocate if out has the capacity.
+    void appendContent(int lineIndex, std::string& out) const {
+        const std::string& w = word(lineIndex);
+        for (int i = 0; i < repetitions; ++i) {
+            out += w;
+            if (i < repetitions - 1) out += separator;
+        }
+    }
+
+private:
+    std::string words[2];
+    std::string separator;
+    int repetitions;
+};
+
+void stripColorCodesInto(const std::string& str, std::string& result) {
+    result.clear();
     for (size_t i = 0; i < str.length(); ++i) {
         if (str[i] == '\033' && i + 1 < str.length() && str[i+1] == '[') {
             i += 2;
@@ -240,9 +446,25 @@ std::string stripColorCodes(const std::string& str) {
             result += str[i];
         }
     }
+}
+
+std::string stripColorCodes(const std::string& str) {
+    std::string result;
+    result.reserve(str.length());
+    stripColorCodesInto(str, result);
     return result;
 }
 
+void appendNumber(std::string& out, long long value) {
+    char digits[24];
+    int n = 0;
+    do {
+        digits[n++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (n > 0) out += digits[--n];
+}
+
 std::string glitch(const std::string& str, int intensity) {
     std::string result = str;
     auto& gen = RandomEngine::instance().gen();
@@ -299,108 +521,221 @@ void printLine(int lineIndex, int totalLines, const std::string& content,
     std::cout << std::endl;
 }
 
+size_t numberWidth(int lineIndex) {
+    return std::to_string(lineIndex + 1).length() + 2;
+}
+
+size_t lineWidth(const LineSource& source, int lineIndex, bool hasNumber, bool hasBorder) {
+    size_t width = source.contentLength();
+    if (hasNumber) width += numberWidth(lineIndex);
+    if (hasBorder) width += 5;
+    return width;
+}
+
+// Bytes of the border around a line. The glyphs may be multi-byte UTF-8, so
+// this is larger than the 5 cells lineWidth() counts for them.
+size_t borderBytes(int lineIndex, int totalLines) {
+    return std::strlen(Console::borderStart(lineIndex, totalLines)) + 1
+         + std::strlen(Console::borderEnd(lineIndex, totalLines));
+}
+
+bool isVisible(size_t col, size_t cells, size_t colStart, size_t colEnd) {
+    return col < colEnd && col + cells > colStart;
+}
+
+// Prints the single-byte cells of text that fall into [colStart, colEnd).
+void printCells(std::ostream& out, const std::string& text,
+                size_t& col, size_t colStart, size_t colEnd) {
+    size_t from = std::max(col, colStart);
+    size_t to = std::min(col + text.length(), colEnd);
+    if (from < to) {
+        out << text.substr(from - col, to - from);
+    }
+    col += text.length();
+}
+
+// Prints a multi-byte glyph occupying one cell if it is visible.
+void printGlyph(std::ostream& out, const std::string& glyph,
+                size_t& col, size_t colStart, size_t colEnd) {
+    if (col >= colStart && col < colEnd) {
+        out << glyph;
+    }
+    ++col;
+}
+
+// Same layout as printLine(), but only the cells in [colStart, colStart + width)
+// are generated, so the cost is independent of the line length. No newline.
+// Colours go through Console, so colored output is only meaningful on std::cout.
+void printLineWindow(std::ostream& out, const LineSource& source, int lineIndex, int totalLines,
+                     size_t colStart, size_t width,
+                     bool hasNumber, bool hasBorder, bool rainbow, bool colored) {
+    size_t colEnd = (width > SIZE_MAX - colStart) ? SIZE_MAX : colStart + width;
+    size_t col = 0;
+
+    if (hasNumber) {
+        size_t cells = numberWidth(lineIndex);
+        if (isVisible(col, cells, colStart, colEnd)) {
+            if (colored) Console::setYellow();
+            printCells(out, std::to_string(lineIndex + 1) + ": ", col, colStart, colEnd);
+            if (colored) Console::reset();
+        } else {
+            col += cells;
+        }
+    }
+
+    if (hasBorder) {
+        if (isVisible(col, 2, colStart, colEnd)) {
+            std::string start = Console::borderStart(lineIndex, totalLines);
+            if (colored) Console::setCyan();
+            printGlyph(out, start.substr(0, start.length() - 1), col, colStart, colEnd);
+            printCells(out, " ", col, colStart, colEnd);
+            if (colored) Console::reset();
+        } else {
+            col += 2;
+        }
+    }
+
+    size_t length = source.contentLength();
+    size_t from = std::max(col, colStart);
+    size_t to = std::min(col + length, colEnd);
+    if (from < to) {
+        if (rainbow && colored) {
+            for (size_t j = from - col; j < to - col; ++j) {
+                Console::setColor(static_cast<int>((lineIndex + j) % 6));
+                out << source.charAt(lineIndex, j);
+            }
+            Console::reset();
+        } else {
+            std::string visible;
+            visible.reserve(to - from);
+            for (size_t j = from - col; j < to - col; ++j) {
+                visible += source.charAt(lineIndex, j);
+            }
+            out << visible;
+        }
+    }
+    col += length;
+
+    if (hasBorder) {
+        printCells(out, " ", col, colStart, colEnd);
+        if (isVisible(col, 2, colStart, colEnd)) {
+            std::string end = Console::borderEnd(lineIndex, totalLines);
+            if (colored) Console::setCyan();
+            printCells(out, " ", col, colStart, colEnd);
+            printGlyph(out, end.substr(1), col, colStart, colEnd);
+            if (colored) Console::reset();
+        }
+    }
+}
+
 void clearLine() {
     Console::clearLine();
 }
 
-void typewriterEffect(const std::string& text, int delayMs, int effect, int param) {
+// Scratch storage for the animated path. Reserved once per run for the widest
+// line and reused for every line and frame, so frames do not allocate.
+struct FrameBuffers {
+    std::string line;
+    std::string display;
+    std::string frame;
+    std::vector<char> revealed;
+
+    void reserve(size_t capacity) {
+        line.reserve(capacity);
+        display.reserve(capacity);
+        frame.reserve(capacity);
+        revealed.reserve(capacity);
+    }
+};
+
+void showFrame(const char* data, size_t length) {
+    clearLine();
+    std::cout.write(data, length);
+#ifdef VOIDER_COUNT_ALLOCS
+    ++AllocCounter::frames;
+#endif
+}
+
+void typewriterEffect(const std::string& text, int delayMs, int effect, int param,
+                      FrameBuffers& buffers) {
     if (delayMs <= 0) {
         std::cout << text << std::endl;
         return;
     }
 
+    size_t len = text.length();
+    std::string& frame = buffers.frame;
+
     if (effect == 0) {
-        for (size_t i = 0; i <= text.length(); ++i) {
-            clearLine();
-            std::cout << text.substr(0, i);
+        for (size_t i = 0; i <= len; ++i) {
+            showFrame(text.data(), i);
             std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
         }
         std::cout << std::endl;
     }
     else if (effect == 1) {
-        int wave = (param > 0) ? param : 3;
-        for (size_t i = 0; i <= text.length(); ++i) {
-            clearLine();
-            std::cout << text.substr(0, i);
-            for (int j = 1; j <= wave && i + j <= text.length(); ++j) {
-                std::cout << text[i + j - 1];
-            }
+        size_t wave = (param > 0) ? param : 3;
+        for (size_t i = 0; i <= len; ++i) {
+            showFrame(text.data(), std::min(len, i + wave));
             std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
         }
         std::cout << std::endl;
     }
     else if (effect == 2) {
-        std::vector<std::string> frames;
-        size_t len = text.length();
         for (size_t i = 0; i <= len; ++i) {
-            std::string frame;
-            frame.reserve(len);
-            for (size_t j = 0; j < len; ++j) {
-                if (j < i) frame += text[j];
-                else if (j == i && i < len) frame += "#";
-                else frame += ".";
-            }
-            frames.push_back(frame);
+            frame.assign(text, 0, i);
+            if (i < len) frame += '#';
+            frame.append(len - frame.length(), '.');
+            showFrame(frame.data(), frame.length());
+            std::this_thread::sleep_for(std::chrono::milliseconds(delayMs / 2));
         }
         for (size_t i = len; i > 0; --i) {
-            std::string frame;
-            frame.reserve(len);
-            for (size_t j = 0; j < len; ++j) {
-                if (j < i - 1) frame += text[j];
-                else if (j == i - 1) frame += "#";
-                else frame += ".";
-            }
-            frames.push_back(frame);
-        }
-        frames.push_back(text);
-
-        for (const auto& frame : frames) {
-            clearLine();
-            std::cout << frame;
+            frame.assign(text, 0, i - 1);
+            frame += '#';
+            frame.append(len - i, '.');
+            showFrame(frame.data(), frame.length());
             std::this_thread::sleep_for(std::chrono::milliseconds(delayMs / 2));
         }
+        showFrame(text.data(), len);
+        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs / 2));
         std::cout << std::endl;
     }
     else if (effect == 3) {
         int steps = (param > 0) ? param : 10;
         for (int i = 0; i <= steps; ++i) {
             float progress = static_cast<float>(i) / steps;
-            int pos = static_cast<int>(progress * text.length());
-            clearLine();
-            std::cout << text.substr(0, pos);
-            if (pos < static_cast<int>(text.length())) {
-                std::cout << "_";
-            }
+            size_t pos = static_cast<size_t>(progress * len);
+            frame.assign(text, 0, pos);
+            if (pos < len) frame += '_';
+            showFrame(frame.data(), frame.length());
             std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
         }
-        clearLine();
-        std::cout << text << std::endl;
+        showFrame(text.data(), len);
+        std::cout << std::endl;
     }
     else if (effect == 4) {
-        size_t len = text.length();
-        for (int i = len; i >= 0; --i) {
-            clearLine();
-            std::cout << std::string(len - i, ' ') << text.substr(0, i);
+        for (size_t i = len + 1; i-- > 0;) {
+            frame.assign(len - i, ' ');
+            frame.append(text, 0, i);
+            showFrame(frame.data(), frame.length());
             std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
         }
         std::cout << std::endl;
     }
     else if (effect == 5) {
-        size_t len = text.length();
-        std::string current(len, '_');
-        std::vector<bool> revealed(len, false);
-        int revealedCount = 0;
+        frame.assign(len, '_');
+        buffers.revealed.assign(len, 0);
+        size_t revealedCount = 0;
         auto& gen = RandomEngine::instance().gen();
-        std::uniform_int_distribution<> dis(0, len - 1);
+        std::uniform_int_distribution<size_t> dis(0, len > 0 ? len - 1 : 0);
 
-        while (revealedCount < static_cast<int>(len)) {
-            int idx = dis(gen);
-            if (!revealed[idx]) {
-                revealed[idx] = true;
-                current[idx] = text[idx];
+        while (revealedCount < len) {
+            size_t idx = dis(gen);
+            if (!buffers.revealed[idx]) {
+                buffers.revealed[idx] = 1;
+                frame[idx] = text[idx];
                 revealedCount++;
-                clearLine();
-                std::cout << current;
+                showFrame(frame.data(), frame.length());
                 std::this_thread::sleep_for(std::chrono::milliseconds(delayMs * 2));
             }
         }
@@ -444,7 +779,10 @@ void printUsage(const char* programName) {
     std::cout << "  -x, --matrix        - matrix style\n\n";
 
     std::cout << "ADDITIONAL:\n";
-    std::cout << "  -o, --output <file> - save to file\n";
+    std::cout << "  -R, --range <a:b>   - show only lines a..b\n";
+    std::cout << "  -C, --cols <a:b>    - show only columns a..b of each line\n";
+    std::cout << "  -P, --pager         - interactive viewer (arrows/hjkl, space/b, g/G, : goto, q)\n";
+    std::cout << "  -o, --output <file> - save to file (only lines/columns chosen by -R/-C)\n";
     std::cout << "  -h, --help          - show this help\n\n";
 
     std::cout << "EXAMPLES:\n";
@@ -453,6 +791,7 @@ void printUsage(const char* programName) {
     std::cout << "  " << programName << " -a -b -n 4 2 rainbow\n";
     std::cout << "  " << programName << " -d 30 -e 2 -f 3 3 matrix\n";
     std::cout << "  " << programName << " -g 2 -x 2 5 glitch\n";
+    std::cout << "  " << programName << " -n -R 40000000:40000005 -C 1:60 50000000 1000000 void\n";
 }
 
 struct Config {
@@ -466,6 +805,7 @@ struct Config {
     bool mirror = false;
     bool rainbow = false;
     bool matrix = false;
+    bool pager = false;
     std::string separator = " ";
     std::string outputFile;
     int pattern = 1;
@@ -475,9 +815,26 @@ struct Config {
     int glitchIntensity = 0;
     int lines = 0;
     int repetitions = 0;
+    long long rangeStart = 0;
+    long long rangeEnd = 0;
+    long long colStart = 0;
+    long long colEnd = 0;
     std::string word;
 };
 
+// Parses "a:b", "a:", ":b" or "a" (1-based, inclusive). Missing bounds stay 0.
+bool parseSpan(const std::string& text, long long& start, long long& end) {
+    size_t colon = text.find(':');
+    std::string first = text.substr(0, colon);
+    std::string second = (colon == std::string::npos) ? first : text.substr(colon + 1);
+    start = first.empty() ? 0 : std::atoll(first.c_str());
+    end = second.empty() ? 0 : std::atoll(second.c_str());
+    if (start < 0 || end < 0) return false;
+    if (!first.empty() && start == 0) return false;
+    if (!second.empty() && end == 0) return false;
+    return end == 0 || start <= end;
+}
+
 bool parseArgs(int argc, char* argv[], Config& cfg) {
     if (argc < 2) {
         printUsage(argv[0]);
@@ -517,6 +874,18 @@ bool parseArgs(int argc, char* argv[], Config& cfg) {
             cfg.rainbow = true;
         } else if (arg == "-x" || arg == "--matrix") {
             cfg.matrix = true;
+        } else if (arg == "-P" || arg == "--pager") {
+            cfg.pager = true;
+        } else if (arg == "-R" || arg == "--range") {
+            if (i + 1 < args.size() && !parseSpan(args[++i], cfg.rangeStart, cfg.rangeEnd)) {
+                std::cout << "Error: invalid range " << args[i] << "\n";
+                return false;
+            }
+        } else if (arg == "-C" || arg == "--cols") {
+            if (i + 1 < args.size() && !parseSpan(args[++i], cfg.colStart, cfg.colEnd)) {
+                std::cout << "Error: invalid column range " << args[i] << "\n";
+                return false;
+            }
         } else if (arg == "-s" || arg == "--separator") {
             if (i + 1 < args.size()) {
                 cfg.separator = args[++i];
@@ -573,9 +942,126 @@ bool parseArgs(int argc, char* argv[], Config& cfg) {
         return false;
     }
 
+    if (cfg.rangeStart > cfg.lines) {
+        std::cout << "Error: range starts after the last line.\n";
+        return false;
+    }
+    if (cfg.rangeEnd == 0 || cfg.rangeEnd > cfg.lines) cfg.rangeEnd = cfg.lines;
+    if (cfg.rangeStart == 0) cfg.rangeStart = 1;
+
+    if (cfg.delayMs > 0 && cfg.pager) {
+        std::cout << "Error: --pager cannot be combined with --delay.\n";
+        return false;
+    }
+    if (cfg.delayMs > 0 && (cfg.colStart > 0 || cfg.colEnd > 0)) {
+        std::cout << "Error: --cols cannot be combined with --delay.\n";
+        return false;
+    }
+
     return true;
 }
 
+// Interactive viewer: only the lines and columns on screen are ever generated.
+void runPager(const LineSource& source, const Config& cfg) {
+    long long first = cfg.rangeStart - 1;
+    long long last = cfg.rangeEnd - 1;
+    long long top = first;
+    size_t maxWidth = lineWidth(source, static_cast<int>(last), cfg.addNumbers, cfg.addBorder);
+    size_t spanStart = (cfg.colStart > 0) ? static_cast<size_t>(cfg.colStart - 1) : 0;
+    size_t spanEnd = (cfg.colEnd > 0) ? std::min(static_cast<size_t>(cfg.colEnd), maxWidth) : maxWidth;
+    spanEnd = std::max(spanStart, spanEnd);
+    size_t left = spanStart;
+
+    int rows = 24;
+    int cols = 80;
+    bool interactive = Console::isInteractive();
+
+    if (interactive) {
+        Console::enterRawMode();
+        std::cout << "\x1b[?1049h\x1b[?25l";
+    }
+
+    std::string prompt;
+    bool prompting = false;
+
+    while (true) {
+        Console::terminalSize(rows, cols);
+        long long viewRows = std::max(1, rows - 1);
+        size_t viewCols = static_cast<size_t>(std::max(1, cols));
+
+        long long maxTop = std::max(first, last - viewRows + 1);
+        top = std::max(first, std::min(top, maxTop));
+        size_t maxLeft = (spanEnd - spanStart > viewCols) ? spanEnd - viewCols : spanStart;
+        left = std::max(spanStart, std::min(left, maxLeft));
+        size_t viewWidth = std::min(viewCols, spanEnd - left);
+
+        if (interactive) std::cout << "\x1b[H\x1b[J";
+        for (long long r = 0; r < viewRows; ++r) {
+            long long line = top + r;
+            if (line <= last) {
+                printLineWindow(std::cout, source, static_cast<int>(line), cfg.lines, left, viewWidth,
+                                cfg.addNumbers, cfg.addBorder, cfg.rainbow, true);
+            } else if (interactive) {
+                std::cout << "~";
+            } else {
+                break;
+            }
+            std::cout << "\n";
+        }
+
+        if (!interactive) {
+            std::cout << std::flush;
+            return;
+        }
+
+        std::ostringstream status;
+        if (prompting) {
+            status << ":" << prompt;
+        } else {
+            status << "lines " << (top + 1) << "-" << std::min(top + viewRows, last + 1)
+                   << " of " << cfg.lines << "  col " << (left + 1)
+                   << "  (arrows/hjkl, space/b, g/G, : goto, q quit)";
+        }
+        std::string statusText = status.str().substr(0, viewCols);
+        std::cout << "\x1b[7m" << statusText << "\x1b[0m" << std::flush;
+
+        int key = Console::readKey();
+
+        if (prompting) {
+            if (key >= '0' && key <= '9') {
+                prompt += static_cast<char>(key);
+            } else if ((key == 127 || key == 8) && !prompt.empty()) {
+                prompt.erase(prompt.length() - 1);
+            } else if (key == '\r' || key == '\n') {
+                if (!prompt.empty()) top = std::atoll(prompt.c_str()) - 1;
+                prompting = false;
+            } else if (key == 27 || key == 3) {
+                prompting = false;
+            }
+            continue;
+        }
+
+        if (key == 'q' || key == 'Q' || key == 3 || key == 27) break;
+        else if (key == Keys::Down || key == 'j') ++top;
+        else if (key == Keys::Up || key == 'k') --top;
+        else if (key == Keys::PageDown || key == ' ' || key == 'f') top += viewRows;
+        else if (key == Keys::PageUp || key == 'b') top -= viewRows;
+        else if (key == Keys::Home || key == 'g') top = first;
+        else if (key == Keys::End || key == 'G') top = maxTop;
+        else if (key == Keys::Right || key == 'l') left += viewCols / 2;
+        else if (key == Keys::Left || key == 'h') left -= std::min(left - spanStart, viewCols / 2);
+        else if (key == '0') left = spanStart;
+        else if (key == '$') left = maxLeft;
+        else if (key == ':') {
+            prompting = true;
+            prompt.clear();
+        }
+    }
+
+    std::cout << "\x1b[?25h\x1b[?1049l" << std::flush;
+    Console::leaveRawMode();
+}
+
 int main(int argc, char* argv[]) {
     Console::init();
 
@@ -604,27 +1090,23 @@ int main(int argc, char* argv[]) {
         cleanWord = cleanWord + " | " + reversed;
     }
 
-    std::vector<std::string> contentLines;
-    contentLines.reserve(cfg.lines);
-
-    for (int i = 0; i < cfg.lines; ++i) {
-        std::string content;
-        if (cfg.pattern == 1) {
-            content = repeat(cleanWord, cfg.repetitions, cfg.separator);
-        } else if (cfg.pattern == 2) {
-            if (i % 2 == 0) {
-                content = repeat(toUpper(cleanWord), cfg.repetitions, cfg.separator);
-            } else {
-                content = repeat(toLower(cleanWord), cfg.repetitions, cfg.separator);
-            }
-        }
-        contentLines.push_back(content);
-    }
+    LineSource source(cleanWord, cfg.separator, cfg.repetitions, cfg.pattern);
+    int firstLine = static_cast<int>(cfg.rangeStart - 1);
+    int lastLine = static_cast<int>(cfg.rangeEnd - 1);
+    bool windowed = cfg.colStart > 0 || cfg.colEnd > 0;
+    size_t colStart = (cfg.colStart > 0) ? static_cast<size_t>(cfg.colStart - 1) : 0;
+    size_t colWidth = (cfg.colEnd > 0) ? static_cast<size_t>(cfg.colEnd) - colStart : SIZE_MAX;
 
     if (!cfg.outputFile.empty()) {
         std::ofstream file(cfg.outputFile);
         if (file.is_open()) {
-            for (int i = 0; i < cfg.lines; ++i) {
+            for (int i = firstLine; i <= lastLine; ++i) {
+                if (windowed) {
+                    printLineWindow(file, source, i, cfg.lines, colStart, colWidth,
+                                    cfg.addNumbers, cfg.addBorder, false, false);
+                    file << std::endl;
+                    continue;
+                }
                 std::string line;
                 if (cfg.addNumbers) {
                     line += std::to_string(i + 1) + ": ";
@@ -632,7 +1114,7 @@ int main(int argc, char* argv[]) {
                 if (cfg.addBorder) {
                     line += Console::borderStart(i, cfg.lines);
                 }
-                line += contentLines[i];
+                line += source.content(i);
                 if (cfg.addBorder) {
                     line += " ";
                     line += Console::borderEnd(i, cfg.lines);
@@ -646,41 +1128,70 @@ int main(int argc, char* argv[]) {
         }
     }
 
-    if (cfg.delayMs > 0) {
-        for (size_t i = 0; i < contentLines.size(); ++i) {
-            std::string displayLine;
+    if (cfg.pager) {
+        runPager(source, cfg);
+    } else if (cfg.delayMs > 0) {
+        FrameBuffers buffers;
+        size_t capacity = source.contentLength();
+        if (cfg.addNumbers) capacity += numberWidth(cfg.lines - 1);
+        if (cfg.addBorder) {
+            capacity += std::max({borderBytes(0, 3), borderBytes(1, 3), borderBytes(2, 3)});
+        }
+        buffers.reserve(capacity);
+        RandomEngine::instance();
+#ifdef VOIDER_COUNT_ALLOCS
+        size_t allocationsBefore = AllocCounter::allocations;
+#endif
+
+        for (int i = firstLine; i <= lastLine; ++i) {
+            std::string& displayLine = buffers.line;
+            displayLine.clear();
             if (cfg.addNumbers) {
-                displayLine += std::to_string(i + 1) + ": ";
+                appendNumber(displayLine, i + 1);
+                displayLine += ": ";
             }
             if (cfg.addBorder) {
                 displayLine += Console::borderStart(i, cfg.lines);
             }
-            displayLine += contentLines[i];
+            source.appendContent(i, displayLine);
             if (cfg.addBorder) {
                 displayLine += " ";
                 displayLine += Console::borderEnd(i, cfg.lines);
             }
 
-            std::string cleanDisplay = stripColorCodes(displayLine);
-            typewriterEffect(cleanDisplay, cfg.delayMs, cfg.effectType, cfg.waveSize);
+            const std::string& cleanDisplay = buffers.display;
+            stripColorCodesInto(displayLine, buffers.display);
+            typewriterEffect(cleanDisplay, cfg.delayMs, cfg.effectType, cfg.waveSize, buffers);
 
-            if (cfg.fadeOut && i == contentLines.size() - 1) {
+            if (cfg.fadeOut && i == lastLine) {
                 std::this_thread::sleep_for(std::chrono::milliseconds(cfg.delayMs * 3));
-                for (int j = cleanDisplay.length(); j >= 0; --j) {
-                    clearLine();
-                    std::cout << cleanDisplay.substr(0, j);
+                for (size_t j = cleanDisplay.length() + 1; j-- > 0;) {
+                    showFrame(cleanDisplay.data(), j);
                     std::this_thread::sleep_for(std::chrono::milliseconds(cfg.delayMs / 2));
                 }
                 clearLine();
             }
 
-            if (i < contentLines.size() - 1) {
+            if (i < lastLine) {
                 std::this_thread::sleep_for(std::chrono::milliseconds(cfg.delayMs * 2));
             }
         }
+
+#ifdef VOIDER_COUNT_ALLOCS
+        size_t allocations = AllocCounter::allocations - allocationsBefore;
+        std::cerr << "frames: " << AllocCounter::frames
+                  << ", allocations: " << allocations << std::endl;
+        if (allocations > 0) return 1;
+#endif
+    } else if (windowed) {
+        for (int i = firstLine; i <= lastLine; ++i) {
+            printLineWindow(std::cout, source, i, cfg.lines, colStart, colWidth,
+                            cfg.addNumbers, cfg.addBorder, cfg.rainbow, true);
+            std::cout << std::endl;
+        }
     } else {
-        for (int i = 0; i < cfg.lines; ++i) {
-            printLine(i, cfg.lines, contentLines[i], 
+        for (int i = firstLine; i <= lastLine; ++i) {
+            printLine(i, cfg.lines, source.content(i),
                      cfg.addNumbers, cfg.addBorder, cfg.rainbow);
         }
     }